@@ -13,6 +13,7 @@ TARGET       := libCA.a
 SOURCES      := AS_global.C \
                 \
                 AS_UTL/AS_UTL_decodeRange.C \
+                AS_UTL/AS_UTL_encodeSequence.C \
                 AS_UTL/AS_UTL_fasta.C \
                 AS_UTL/AS_UTL_fileIO.C \
                 AS_UTL/AS_UTL_reverseComplement.C \
@@ -23,6 +24,7 @@ SOURCES      := AS_global.C \
                 AS_UTL/bitEncodings.C \
                 AS_UTL/bitPackedFile.C \
                 AS_UTL/bitPackedArray.C \
+                AS_UTL/compressedStream.C \
                 AS_UTL/dnaAlphabets.C \
                 AS_UTL/md5.C \
                 AS_UTL/mt19937ar.C \
@@ -34,10 +36,12 @@ SOURCES      := AS_global.C \
                 AS_UTL/kMer.C \
                 \
                 stores/gkStore.C \
+                stores/gkReadCache.C \
                 \
                 stores/ovOverlap.C \
                 stores/ovStore.C \
                 stores/ovStoreFile.C \
+                stores/ovTextImport.C \
                 \
                 stores/tgStore.C \
                 stores/tgTig.C \
@@ -57,60 +61,9 @@ SOURCES      := AS_global.C \
                 overlapInCore/liboverlap/prefixEditDistance-extend.C \
                 overlapInCore/liboverlap/prefixEditDistance-forward.C \
                 overlapInCore/liboverlap/prefixEditDistance-reverse.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-5000.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-4900.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-4800.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-4700.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-4600.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-4500.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-4400.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-4300.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-4200.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-4100.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-4000.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-3900.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-3800.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-3700.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-3600.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-3500.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-3400.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-3300.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-3200.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-3100.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-3000.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-2900.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-2800.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-2700.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-2600.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-2500.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-2400.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-2300.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-2200.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-2100.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-2000.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-1900.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-1800.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-1700.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-1600.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-1500.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-1400.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-1300.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-1200.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-1100.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-1000.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-0900.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-0800.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-0700.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-0600.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-0500.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-0400.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-0300.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-0200.C \
-                overlapInCore/liboverlap/prefixEditDistance-matchLimit-0100.C \
                 \
                 utgcns/libNDalign/NDalign.C \
                 \
-                utgcns/libNDalign/Binomial_Bound.C \
                 utgcns/libNDalign/NDalgorithm.C \
                 utgcns/libNDalign/NDalgorithm-allocateMoreSpace.C \
                 utgcns/libNDalign/NDalgorithm-extend.C \
@@ -142,6 +95,7 @@ SUBMAKEFILES := stores/gatekeeperCreate.mk \
                 stores/gatekeeperDumpFASTQ.mk \
                 stores/gatekeeperDumpMetaData.mk \
                 stores/gatekeeperPartition.mk \
+                stores/gkStore-benchmark.mk \
                 stores/ovStoreBuild.mk \
                 stores/ovStoreBucketizer.mk \
                 stores/ovStoreSorter.mk \
@@ -166,6 +120,9 @@ SUBMAKEFILES := stores/gatekeeperCreate.mk \
                 overlapInCore/overlapPair.mk \
                 \
                 overlapInCore/liboverlap/prefixEditDistance-matchLimitGenerate.mk \
+                overlapInCore/liboverlap/prefixEditDistance-benchmark.mk \
+                \
+                utgcns/libNDalign/NDalign-benchmark.mk \
                 \
                 mhap/mhap.mk \
                 mhap/mhapConvert.mk \
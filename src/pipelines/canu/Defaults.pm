@@ -1125,6 +1125,11 @@ sub setDefaults () {
     setOverlapDefaults("obt", "overlap based trimming", "ovl");   #  Overlaps computed for trimming
     setOverlapDefaults("utg", "unitig construction",    "ovl");   #  Overlaps computed for unitigging
 
+    #####  Gatekeeper
+
+    $global{"gkpThreads"}                  = undef;
+    $synops{"gkpThreads"}                  = "Number of threads to use for checking and encoding reads when creating the gkpStore; default is all CPUs";
+
     ##### Overlap Store
 
     $global{"ovlStoreMemory"}              = 2048;
@@ -1155,6 +1160,9 @@ sub setDefaults () {
     $global{"trimReadsCoverage"}           = 1;
     $synops{"trimReadsCoverage"}           = "Minimum depth of evidence to retain bases";
 
+    $global{"obtThreads"}                  = undef;
+    $synops{"obtThreads"}                  = "Number of threads to use for trimReads and splitReads; default is 1";
+
     #$global{"splitReads..."}               = 1;
     #$synops{"splitReads..."}               = "";
 
@@ -193,9 +193,13 @@ sub gatekeeper ($$$@) {
 
     #  Load the store.
 
+    my $thr = getGlobal("gkpThreads");
+    $thr    = getNumberOfCPUs()  if (!defined($thr));
+
     my $cmd;
     $cmd .= "$bin/gatekeeperCreate \\\n";
     $cmd .= "  -minlength " . getGlobal("minReadLength") . " \\\n";
+    $cmd .= "  -threads $thr \\\n";
     $cmd .= "  -o $wrk/$asm.gkpStore.BUILDING \\\n";
     $cmd .= "  $wrk/$asm.gkpStore.gkp \\\n";
     $cmd .= "> $wrk/$asm.gkpStore.err 2>&1";
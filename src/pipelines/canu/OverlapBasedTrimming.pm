@@ -67,6 +67,7 @@ sub trimReads ($$) {
     #$cmd .= "  -Cm $path/$asm.max.clear \\\n"          if (-e "$path/$asm.max.clear");
     $cmd .= "  -ol " . getGlobal("trimReadsOverlap") . " \\\n";
     $cmd .= "  -oc " . getGlobal("trimReadsCoverage") . " \\\n";
+    $cmd .= "  -threads " . getGlobal("obtThreads") . " \\\n"   if (defined(getGlobal("obtThreads")));
     $cmd .= "  -o  $path/$asm.1.trimReads \\\n";
     $cmd .= ">     $path/$asm.1.trimReads.err 2>&1";
 
@@ -122,6 +123,7 @@ sub splitReads ($$) {
     $cmd .= "  -Co $path/$asm.2.splitReads.clear \\\n";
     $cmd .= "  -e  $erate \\\n";
     $cmd .= "  -minlength " . getGlobal("minReadLength") . " \\\n";
+    $cmd .= "  -threads " . getGlobal("obtThreads") . " \\\n"   if (defined(getGlobal("obtThreads")));
     $cmd .= "  -o  $path/$asm.2.splitReads \\\n";
     $cmd .= ">     $path/$asm.2.splitReads.err 2>&1";
 
@@ -365,6 +365,7 @@ sub overlapErrorAdjustmentConfigure ($$) {
     my $maxMem   = getGlobal("oeaMemory") * 1024 * 1024 * 1024;
     my $maxReads = getGlobal("oeaBatchSize");
     my $maxBases = getGlobal("oeaBatchLength");
+    my $numThreads = getGlobal("oeaThreads");
 
     my $reads    = 0;
     my $bases    = 0;
@@ -442,6 +443,7 @@ sub overlapErrorAdjustmentConfigure ($$) {
     print F "    -R \$minid \$maxid \\\n";
     print F "    -e " . getGlobal("utgOvlErrorRate") . " -l " . getGlobal("minOverlapLength") . " \\\n";
     print F "    -c $path/red.red \\\n";
+    print F "    -t $numThreads \\\n";
     print F "    -o $path/\$jobid.oea.WORKING \\\n";
     print F "  && \\\n";
     print F "  mv $path/\$jobid.oea.WORKING $path/\$jobid.oea\n";
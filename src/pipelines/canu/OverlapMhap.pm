@@ -413,6 +413,7 @@ sub mhapConfigure ($$$$) {
     print F "     ! -e \"$path/results/\$qry.ovb.gz\" ] ; then\n";
     print F "  \$bin/mhapConvert \\\n";
     print F "    \$cvt \\\n";
+    print F "    -threads ", getGlobal("${tag}mhapThreads"), " \\\n";
     print F "    -o $path/results/\$qry.mhap.ovb.gz \\\n";
     print F "    $path/results/\$qry.mhap\n";
     print F "fi\n";
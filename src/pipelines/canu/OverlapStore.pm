@@ -213,6 +213,7 @@ sub overlapStoreConfigure ($$$$) {
         print F "\$bin/ovStoreSorter \\\n";
         print F "  -deletelate \\\n";  #  Choices -deleteearly -deletelate or nothing
         print F "  -M " . getGlobal("ovlStoreMemory") . " \\\n";
+        print F "  -t " . getGlobal("ovsThreads") . " \\\n";
         print F "  -o $wrk/$asm.ovlStore.BUILDING \\\n";
         print F "  -g $wrk/$asm.gkpStore \\\n";
         print F "  -F $numSlices \\\n";